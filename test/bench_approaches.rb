@@ -62,4 +62,150 @@ time_hash_creation = Benchmark.measure {
   end
 }
 puts "Pure Ruby Hash creation:   #{(time_hash_creation.real * 1000).round(1)}ms"
-puts "  (This is the floor - native extension would still need to do this)"
+puts "  (Floor for Ruby-level code - every event allocates a fresh span Hash)"
+
+# What a C extension can do that Ruby-level code can't express cheaply:
+# presized arrays, and names and classes interned from the symbol table.
+# Text content can't be interned - each text event needs its own String -
+# and every event has its own position, so each still gets a fresh span
+# Hash. These events are all text, so nothing here is interned (and the
+# "hello" literal is a new String per event: this file has no
+# frozen_string_literal comment). Approximated in Ruby to bound the gain
+# before writing the extension.
+time_hash_presized = Benchmark.measure {
+  iterations.times do
+    events = Array.new(864)
+    864.times do |i|
+      events[i] = { type: :text, content: "hello", span: { start: i, end: i + 5 } }
+    end
+  end
+}
+puts "Hash, presized array:      #{(time_hash_presized.real * 1000).round(1)}ms"
+puts "  (Event Hash, span Hash and content String per event - approximate floor for a C extension)"
+
+# Packed records + one small wrapper per event, fields decoded on access.
+# The unpack case's 20-byte layout grown to 36 bytes: type, span start/end,
+# then three (offset, length) slices into a string arena - primary (content,
+# element name or attribute key), secondary (element id or attribute value)
+# and classes (space-joined). A missing field has length NONE; a value that
+# isn't a String has length OBJECT and its offset indexes a side array.
+# Records are packed from the real comprehensive.udon event stream, and
+# both representations are traversed with traverse_udon_events itself.
+class PackedEvent
+  RECORD = 36
+  NONE = 0xFFFF_FFFF
+  OBJECT = 0xFFFF_FFFE
+  PRIMARY = {
+    text: :content, comment: :content, raw_content: :content,
+    element_start: :name, embedded_start: :name, attribute: :key
+  }.freeze
+  SECONDARY = { element_start: :id, embedded_start: :id, attribute: :value }.freeze
+  CLASSES = %i[element_start embedded_start].freeze
+  EMPTY = [].freeze
+
+  # Type symbols are interned in first-seen order, so any event kind the
+  # parser emits gets a slot.
+  Packed = Struct.new(:buf, :arena, :objects, :types, :count) do
+    include Enumerable
+
+    def each
+      count.times { |i| yield PackedEvent.new(self, i) }
+    end
+  end
+
+  def self.pack(events)
+    arena = String.new(encoding: Encoding::UTF_8)
+    packed = Packed.new(String.new, arena, [], [], events.size)
+    events.each do |event|
+      type = event[:type]
+      index = packed.types.index(type) || (packed.types << type).size - 1
+      classes = event[:classes]
+      packed.buf << [
+        index, event[:span][:start], event[:span][:end],
+        *slot(packed, PRIMARY[type] && event[PRIMARY[type]]),
+        *slot(packed, SECONDARY[type] && event[SECONDARY[type]]),
+        *slot(packed, classes && !classes.empty? ? classes.join(" ") : nil)
+      ].pack("L<*")
+    end
+    packed
+  end
+
+  def self.slot(packed, value)
+    case value
+    when nil then [0, NONE]
+    when String
+      offset = packed.arena.bytesize
+      packed.arena << value.b.force_encoding(Encoding::UTF_8)
+      [offset, value.bytesize]
+    else
+      packed.objects << value
+      [packed.objects.size - 1, OBJECT]
+    end
+  end
+
+  def initialize(packed, index)
+    @packed = packed
+    @base = index * RECORD
+  end
+
+  def type = @packed.types[@packed.buf.unpack1("L<", offset: @base)]
+  def span_start = @packed.buf.unpack1("L<", offset: @base + 4)
+  def span_end = @packed.buf.unpack1("L<", offset: @base + 8)
+
+  # Hash-compatible access for existing consumers. Keys the layout does not
+  # carry (e.g. :message, :suffix) raise rather than read as nil, so this
+  # prototype can't be mistaken for a drop-in Hash.
+  def [](key)
+    case key
+    when :type then type
+    when :span then { start: span_start, end: span_end }
+    when :content, :name, :key then slice(12) if PRIMARY[type] == key
+    when :id, :value then slice(20) if SECONDARY[type] == key
+    when :classes then (slice(28)&.split(" ") || EMPTY) if CLASSES.include?(type)
+    else raise KeyError, "PackedEvent has no #{key.inspect} field"
+    end
+  end
+
+  private
+
+  def slice(at)
+    offset, length = @packed.buf.unpack("L<L<", offset: @base + at)
+    case length
+    when NONE then nil
+    when OBJECT then @packed.objects[offset]
+    else @packed.arena.byteslice(offset, length)
+    end
+  end
+end
+
+# Defines traverse_udon_events without running the comparison benchmark
+require_relative 'benchmark'
+
+hash_events = Udon.parse(content)
+packed = PackedEvent.pack(hash_events)
+unless traverse_udon_events(packed) == traverse_udon_events(hash_events)
+  abort "Packed events traverse differently from Hash events"
+end
+
+time_hash_rebuild = Benchmark.measure {
+  iterations.times do
+    hash_events.map { |event| event.merge(span: { start: event[:span][:start], end: event[:span][:end] }) }
+  end
+}
+
+time_traverse_hash = Benchmark.measure {
+  iterations.times { traverse_udon_events(hash_events) }
+}
+
+time_traverse_packed = Benchmark.measure {
+  iterations.times { traverse_udon_events(packed) }
+}
+
+puts
+puts "Traversal with traverse_udon_events, #{hash_events.size} comprehensive.udon events:"
+puts "Hash events (prebuilt):    #{(time_traverse_hash.real * 1000).round(1)}ms"
+puts "Hash rebuild + traversal:  #{((time_hash_rebuild.real + time_traverse_hash.real) * 1000).round(1)}ms"
+puts "  (Fresh event + span Hash per event, strings shared - a lower bound on eager creation)"
+puts "Packed lazy events (Ruby): #{(time_traverse_packed.real * 1000).round(1)}ms"
+puts "  (One small object per event, but each field decode is an unpack1 call -"
+puts "   accessors must be native for lazy decoding to beat eager Hashes)"
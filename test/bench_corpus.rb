@@ -0,0 +1,93 @@
+#!/usr/bin/env ruby
+# Corpus-scale ingestion: many small files, one entity per file
+#
+# Replicates the small files in examples/ into a temp directory (hard links,
+# so the page cache is shared and we measure syscalls, not disk) and reports
+# files/s and MB/s for reading alone and for reading + parsing. The temp
+# directory sits next to examples/ so the links stay on one filesystem; if
+# linking still fails the run aborts rather than copying gigabytes.
+#
+# Run: ruby test/bench_corpus.rb [replicas]   (default 10_000)
+
+require_relative '../lib/udon'
+require 'benchmark'
+require 'etc'
+require 'tmpdir'
+
+replicas = (ARGV[0] || 10_000).to_i
+max_file_size = 1_000_000  # cover-2.udon is a single-file benchmark, not corpus
+
+examples_dir = File.expand_path('../examples', __dir__)
+sources = Dir[File.join(examples_dir, '*.udon')]
+  .reject { |path| File.size(path) > max_file_size }
+  .sort
+
+def replicate(sources, replicas, dir)
+  paths = []
+  replicas.times do |r|
+    shard = File.join(dir, format('%05d', r))
+    Dir.mkdir(shard)
+    sources.each do |src|
+      dst = File.join(shard, File.basename(src))
+      begin
+        File.link(src, dst)
+      rescue SystemCallError => e
+        abort "\nCannot hard-link #{src} into #{dir} (#{e.message}); " \
+              "copies would not share the page cache"
+      end
+      paths << dst
+    end
+  end
+  paths
+end
+
+def report(label, files, bytes, seconds)
+  files_per_sec = files / seconds
+  mb_per_sec = bytes / 1_000_000.0 / seconds
+  puts "  #{label.ljust(28)} #{(seconds * 1000).round(1).to_s.rjust(10)}ms  " \
+       "#{files_per_sec.round.to_s.rjust(9)} files/s  #{mb_per_sec.round(1).to_s.rjust(7)} MB/s"
+end
+
+Dir.mktmpdir('udon-corpus', File.dirname(examples_dir)) do |dir|
+  print "Replicating #{sources.size} files x #{replicas}... "
+  paths = replicate(sources, replicas, dir)
+  total_bytes = paths.sum { |p| File.size(p) }
+  puts "#{paths.size} files, #{(total_bytes / 1_000_000.0).round(1)} MB"
+  puts
+
+  # Warm the page cache so every variant sees the same state
+  paths.each { |p| File.binread(p) }
+
+  time_read = Benchmark.measure {
+    paths.each { |p| File.binread(p) }
+  }
+
+  events = 0
+  time_parse = Benchmark.measure {
+    paths.each { |p| events += Udon.parse(File.binread(p)).size }
+  }
+
+  # Thread pool: reads release the GVL, so this shows how much of the
+  # sequential time is syscall latency that overlapping could hide
+  workers = Etc.nprocessors
+  queue = Queue.new
+  paths.each { |p| queue << p }
+  workers.times { queue << nil }
+  time_pool = Benchmark.measure {
+    Array.new(workers) {
+      Thread.new do
+        while (p = queue.pop)
+          Udon.parse(File.binread(p))
+        end
+      end
+    }.each(&:join)
+  }
+
+  puts "#{paths.size} files, #{events} events:"
+  puts
+  report('Read only', paths.size, total_bytes, time_read.real)
+  report('Read + parse', paths.size, total_bytes, time_parse.real)
+  report("Read + parse (#{workers} threads)", paths.size, total_bytes, time_pool.real)
+  puts
+  puts "Read share of sequential ingest: #{(time_read.real / time_parse.real * 100).round(1)}%"
+end
@@ -0,0 +1,69 @@
+#!/usr/bin/env ruby
+# Error recovery cost: does a document with scattered local errors parse as
+# fast as a clean one?
+#
+# Inserts line-local mistakes agents tend to make (unclosed id bracket, bad
+# escape, unterminated quote, tab indentation) before a fixed fraction of
+# non-blank lines, at that line's indentation, and compares throughput
+# against the clean file. A resynchronizing parser should stay within a few
+# percent; a backtracking one falls off a cliff. Multi-line constructs such
+# as an unclosed `|{` are deliberately left out: they are not local errors.
+# The error count shows whether the parser flagged each inserted line.
+#
+# Run: ruby test/bench_recovery.rb [file] [rate]   (default comprehensive.udon, 0.01)
+
+require_relative '../lib/udon'
+require 'benchmark'
+
+path = ARGV[0] || File.expand_path('../examples/comprehensive.udon', __dir__)
+rate = (ARGV[1] || 0.01).to_f
+clean = File.read(path, encoding: 'UTF-8')
+
+CORRUPTIONS = [
+  '|item[unclosed',          # unclosed id bracket
+  ':note "bad \\q escape"',   # invalid escape in a quoted value
+  ':note "unterminated',      # quote never closed on its line
+  "\t|tabbed"                 # tab in indentation
+].freeze
+
+def corrupt(content, rate)
+  random = Random.new(42)
+  count = 0
+  corrupted = content.each_line.map do |line|
+    next line if line.strip.empty? || random.rand >= rate
+    count += 1
+    indent = line[/\A */]
+    "#{indent}#{CORRUPTIONS[random.rand(CORRUPTIONS.size)]}\n#{line}"
+  end
+  [corrupted.join, count]
+end
+
+dirty, corrupted_lines = corrupt(clean, rate)
+
+puts "=== Error recovery: #{File.basename(path)} ==="
+puts "#{clean.lines.size} lines, #{corrupted_lines} corrupted (#{(rate * 100).round(2)}%)"
+puts
+
+3.times { Udon.parse(clean); Udon.parse(dirty) }
+
+iterations = [1, 2_000_000 / clean.bytesize].max
+
+time_clean = Benchmark.measure { iterations.times { Udon.parse(clean) } }
+time_dirty = Benchmark.measure { iterations.times { Udon.parse(dirty) } }
+
+errors = Udon.parse(dirty).count { |e| e[:type] == :error }
+
+def report(label, bytes, iterations, seconds)
+  mb_per_sec = bytes * iterations / seconds / 1_000_000
+  puts "  #{label.ljust(10)} #{(seconds * 1000 / iterations).round(3).to_s.rjust(9)}ms/parse  " \
+       "#{mb_per_sec.round(1).to_s.rjust(7)} MB/s"
+end
+
+puts "#{iterations} iterations:"
+puts
+report('Clean', clean.bytesize, iterations, time_clean.real)
+report('Corrupted', dirty.bytesize, iterations, time_dirty.real)
+puts
+puts "Error events: #{errors} for #{corrupted_lines} corrupted lines"
+slowdown = (time_dirty.real / time_clean.real - 1) * 100
+puts "Slowdown: #{slowdown.round(1)}% (target: < 5%)"
@@ -49,9 +49,41 @@ time_struct_only = Benchmark.measure {
   end
 }
 
+# Batch pull: one FFI call fills up to BATCH packed events, walked in place
+BATCH = 256
+has_batch = Udon.respond_to?(:udon_parser_next_batch)
+batch_calls = 0
+if has_batch
+  event_size = Udon::UdonEvent.size
+  time_batch_count = Benchmark.measure {
+    iterations.times do
+      input_bytes = content.b
+      buf = FFI::MemoryPointer.from_string(input_bytes)
+      out = FFI::MemoryPointer.new(Udon::UdonEvent, BATCH)
+      parser = Udon.udon_parser_new(buf, input_bytes.bytesize)
+      count = 0
+      loop do
+        n = Udon.udon_parser_next_batch(parser, out, BATCH)
+        batch_calls += 1  # The final empty call crosses FFI too
+        break if n.zero?
+        n.times do |i|
+          event = Udon::UdonEvent.new(out + i * event_size)
+          type = event[:event_type]
+          count += 1
+        end
+      end
+      Udon.udon_parser_free(parser)
+    end
+  }
+end
+
 puts "#{iterations} iterations of comprehensive.udon (864 events each):"
 puts
 puts "Count only (FFI calls, no Ruby objects):  #{(time_count_only.real * 1000).round(2)}ms"
+if has_batch
+  puts "Batch pull (#{BATCH}/call + struct access): #{(time_batch_count.real * 1000).round(2)}ms" \
+       "  (#{(batch_calls.to_f / iterations).round(1)} FFI calls/parse)"
+end
 puts "Struct wrap (FFI + struct access):        #{(time_struct_only.real * 1000).round(2)}ms"
 puts "Full (FFI + struct + Hash creation):      #{(time_full.real * 1000).round(2)}ms"
 puts
@@ -59,5 +91,6 @@ puts "Per-parse breakdown:"
 puts "  FFI + count:     #{(time_count_only.real * 1000 / iterations).round(3)}ms"
 puts "  FFI + struct:    #{(time_struct_only.real * 1000 / iterations).round(3)}ms"
 puts "  FFI + Hash:      #{(time_full.real * 1000 / iterations).round(3)}ms"
+puts "  Batch + struct:  #{(time_batch_count.real * 1000 / iterations).round(3)}ms" if has_batch
 puts
 puts "Hash creation overhead: #{((time_full.real - time_struct_only.real) / time_full.real * 100).round(1)}% of total"
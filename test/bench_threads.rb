@@ -0,0 +1,59 @@
+#!/usr/bin/env ruby
+# Concurrent parsing: does Udon.parse scale across threads and Ractors?
+#
+# Parses the same batch of documents with 1, 2, 4, ... threads. If the
+# native parse holds the GVL throughout, wall time stays flat; if it
+# releases the GVL while tokenizing, wall time drops with thread count
+# until object materialization dominates.
+#
+# Run: ruby test/bench_threads.rb
+
+require_relative '../lib/udon'
+require 'benchmark'
+require 'etc'
+
+path = File.expand_path('../examples/comprehensive.udon', __dir__)
+content = File.read(path).freeze
+documents = 256
+
+puts "=== Concurrent parsing: #{documents} x comprehensive.udon ==="
+puts
+
+3.times { Udon.parse(content) }
+
+def parse_with_threads(content, documents, threads)
+  per_thread = documents / threads
+  Array.new(threads) {
+    Thread.new { per_thread.times { Udon.parse(content) } }
+  }.each(&:join)
+end
+
+thread_counts = [1, 2, 4, 8, 16].select { |n| n <= Etc.nprocessors }
+baseline = nil
+
+thread_counts.each do |threads|
+  time = Benchmark.measure { parse_with_threads(content, documents, threads) }
+  baseline ||= time.real
+  mb_per_sec = content.bytesize * documents / time.real / 1_000_000
+  puts "  #{threads.to_s.rjust(2)} threads: #{(time.real * 1000).round(1).to_s.rjust(8)}ms  " \
+       "#{mb_per_sec.round(1).to_s.rjust(7)} MB/s  #{(baseline / time.real).round(2)}x"
+end
+
+puts
+ractors = thread_counts.last
+begin
+  Warning[:experimental] = false
+  time = Benchmark.measure {
+    Array.new(ractors) {
+      Ractor.new(content, documents / ractors) do |doc, n|
+        n.times { Udon.parse(doc) }
+        n
+      end
+    }.each(&:take)
+  }
+  puts "  #{ractors.to_s.rjust(2)} ractors: #{(time.real * 1000).round(1).to_s.rjust(8)}ms  " \
+       "#{(baseline / time.real).round(2)}x"
+rescue Ractor::RemoteError, Ractor::UnsafeError => e
+  cause = e.respond_to?(:cause) && e.cause ? e.cause : e
+  puts "  Ractors: not supported (#{cause.class}: #{cause.message.lines.first.chomp})"
+end
@@ -247,6 +247,9 @@ def format_time(seconds)
   end
 end
 
+# The definitions above are shared with bench_approaches.rb
+return unless __FILE__ == $PROGRAM_NAME
+
 puts "=" * 70
 puts "UDON Parser Performance Benchmark"
 puts "=" * 70
@@ -24,10 +24,19 @@ module.exports = grammar({
     $.raw_block_content,
     $.freeform_content,
     $._eof,
+    $._balanced_content,
+    // Bare strings: one scanner routine, terminators chosen per context
+    $.block_bare_string,
+    $.sameline_bare_string,
+    $.embedded_bare_string,
+    $.bracket_bare_string,
+    $.array_bare_string,
   ],
 
   extras: $ => [
     /[ \t]/,
+    // A lone '\r' that no text follows (line ends are the scanner's "\r\n")
+    /\r/,
   ],
 
   word: $ => $.identifier,
@@ -289,14 +298,10 @@ module.exports = grammar({
       /u\{[0-9a-fA-F]+\}/,
     ))),
 
-    // Bare strings - different terminators per context
-    block_bare_string: $ => /[^\n;][^\n]*|[^\n ]*;[^\n]*/,
-    sameline_bare_string: $ => /[^ \t\n:\[\];|]+/,
-    embedded_bare_string: $ => /[^ \t\n:\[\];|}]+/,
-    bracket_bare_string: $ => /[^\]\n \t]+/,
-    array_bare_string: $ => /[^ \t\n\[\]]+/,
+    // Bare strings (block, sameline, embedded, bracket, array) are external
+    // tokens; see BARE_STRING_CONTEXTS in src/scanner.c for terminators.
 
-    quoted_identifier: $ => seq("'", /[^'\n]+/, "'"),
+    quoted_identifier: $ => seq("'", /(\r*[^'\r\n])+/, "'"),
 
     // =========================================================================
     // Dynamics
@@ -317,7 +322,7 @@ module.exports = grammar({
     ),
 
     directive_name: $ => $.identifier,
-    directive_args: $ => /[^\n]+/,
+    directive_args: $ => /(\r*[^\r\n])+/,
 
     interpolation: $ => seq(
       '!{{',
@@ -337,10 +342,11 @@ module.exports = grammar({
     filter_name: $ => $.identifier,
     filter_args: $ => /[^|}]+/,
 
+    // Raw content is brace-counted by the scanner: !{:json: {"a": {"b": 1}}}
     inline_directive: $ => seq(
       '!{',
       choice(
-        seq(':', $.identifier, ':', /[^}]*/),
+        seq(':', $.identifier, ':', optional(alias($._balanced_content, $.inline_raw_content))),
         seq($.directive_name, optional(/[^}]*/)),
       ),
       '}',
@@ -350,19 +356,14 @@ module.exports = grammar({
     // Comments
     // =========================================================================
 
-    line_comment: $ => seq(';', optional(/[^\n]*/)),
+    line_comment: $ => seq(';', optional(/(\r*[^\r\n])+/)),
 
     inline_comment: $ => seq(
       ';{',
-      optional($._brace_content),
+      optional($._balanced_content),
       '}',
     ),
 
-    _brace_content: $ => repeat1(choice(
-      /[^{}]+/,
-      seq('{', optional($._brace_content), '}'),
-    )),
-
     // =========================================================================
     // Content
     // =========================================================================
@@ -394,9 +395,10 @@ module.exports = grammar({
     // Text content - excludes special characters that start other constructs
     // Exclude spaces so they're handled as extras, allowing attributes to match
     // Exclude [ : . to allow element_id, attributes, and classes to match
-    sameline_text: $ => /[^ \t|\n;!\[:\].]+/,
+    // A '\r' with text after it is text; otherwise it is an extra
+    sameline_text: $ => /(\r*[^ \t|\r\n;!\[:\].])+/,
     embedded_text: $ => /[^ \t|};!\[:\].]+/,
-    prose_text: $ => /[^ \t|\n;!\[:.]+/,
+    prose_text: $ => /(\r*[^ \t|\r\n;!\[:.])+/,
 
     // =========================================================================
     // Escapes and Special
@@ -405,7 +407,7 @@ module.exports = grammar({
     block_escape: $ => seq(
       choice("'", '\\'),
       choice('|', ';', ':', '!', "'"),
-      optional(/[^\n]*/),
+      optional(/(\r*[^\r\n])+/),
     ),
 
     freeform_block: $ => seq(
@@ -12,8 +12,10 @@
 ; Comments (cool, receding)
 ; =============================================================================
 
-(line_comment) @comment
-(inline_comment) @comment
+[
+  (line_comment)
+  (inline_comment)
+] @comment
 
 ; =============================================================================
 ; Elements - the structural backbone
@@ -21,27 +23,18 @@
 
 ; Element pipe marker - plumbing, should recede
 (element "|" @punctuation.delimiter)
-(embedded_element "|{" @punctuation.delimiter)
-(embedded_element "}" @punctuation.delimiter)
+(embedded_element ["|{" "}"] @punctuation.delimiter)
 
 ; Element name - discriminator, should stand out
 (element_name
-  (identifier) @type)
-
-(element_name
-  (quoted_identifier) @type)
+  [(identifier) (quoted_identifier)] @type)
 
 ; Element ID brackets - plumbing
-(element_id "[" @punctuation.bracket)
-(element_id "]" @punctuation.bracket)
+(element_id ["[" "]"] @punctuation.bracket)
 
 ; Element ID value - discriminator (unique identity)
 (element_id
-  (bracket_bare_string) @label)
-(element_id
-  (quoted_string) @label)
-(element_id
-  (number) @label)
+  [(bracket_bare_string) (quoted_string) (number)] @label)
 
 ; Element class dot - plumbing
 (element_class "." @punctuation.delimiter)
@@ -64,10 +57,7 @@
 
 ; Attribute key - discriminator
 (attribute_key
-  (identifier) @property)
-
-(attribute_key
-  (quoted_identifier) @property)
+  [(identifier) (quoted_identifier)] @property)
 
 ; =============================================================================
 ; Values - typed data
@@ -83,23 +73,23 @@
 (number) @number
 
 ; Strings
-(quoted_string) @string
-(block_bare_string) @string
-(sameline_bare_string) @string
-(embedded_bare_string) @string
-(bracket_bare_string) @string
-(array_bare_string) @string
+[
+  (quoted_string)
+  (block_bare_string)
+  (sameline_bare_string)
+  (embedded_bare_string)
+  (bracket_bare_string)
+  (array_bare_string)
+] @string
 
 ; String delimiters - inner-part coloring (dimmer than content)
-(quoted_string "\"" @string.delimiter)
-(quoted_string "'" @string.delimiter)
+(quoted_string ["\"" "'"] @string.delimiter)
 
 ; Escape sequences within strings
 (escape_sequence) @string.escape
 
 ; Lists
-(list "[" @punctuation.bracket)
-(list "]" @punctuation.bracket)
+(list ["[" "]"] @punctuation.bracket)
 
 ; =============================================================================
 ; Dynamics - evaluation and control flow
@@ -115,8 +105,7 @@
 (directive_args) @variable
 
 ; Raw block
-(raw_block "!:" @keyword.directive)
-(raw_block ":" @keyword.directive)
+(raw_block ["!:" ":"] @keyword.directive)
 (raw_block
   (identifier) @label)
 
@@ -124,8 +113,7 @@
 (raw_block_content) @string.special
 
 ; Interpolation - dynamic values
-(interpolation "!{{" @punctuation.special)
-(interpolation "}}" @punctuation.special)
+(interpolation ["!{{" "}}"] @punctuation.special)
 (expression) @variable
 
 ; Filters in interpolation
@@ -134,17 +122,21 @@
 (filter_args) @variable
 
 ; Inline directive
-(inline_directive "!{" @punctuation.special)
-(inline_directive "}" @punctuation.special)
+(inline_directive ["!{" "}"] @punctuation.special)
+
+; Inline raw content (brace-counted, injected like raw blocks)
+(inline_raw_content) @string.special
 
 ; =============================================================================
 ; Prose and content
 ; =============================================================================
 
 ; Regular prose text - no special highlighting (default foreground)
-(prose_text) @text
-(sameline_text) @text
-(embedded_text) @text
+[
+  (prose_text)
+  (sameline_text)
+  (embedded_text)
+] @text
 
 ; =============================================================================
 ; Escapes
@@ -165,5 +157,7 @@
 ; Identifiers (fallback)
 ; =============================================================================
 
-(identifier) @variable
-(quoted_identifier) @variable
+[
+  (identifier)
+  (quoted_identifier)
+] @variable
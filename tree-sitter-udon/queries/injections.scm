@@ -16,6 +16,14 @@
   (identifier) @injection.language
   (raw_block_content) @injection.content)
 
+; -----------------------------------------------------------------------------
+; Inline raw content: !{:json: {...}}
+; -----------------------------------------------------------------------------
+
+(inline_directive
+  (identifier) @injection.language
+  (inline_raw_content) @injection.content)
+
 ; -----------------------------------------------------------------------------
 ; Freeform blocks with language tag: ```python, ```ruby, etc.
 ; -----------------------------------------------------------------------------
@@ -5,7 +5,10 @@
  * - INDENT/DEDENT tracking (Python-style)
  * - Raw block content (after !:lang:)
  * - Freeform content (between ```)
- * - NEWLINE tracking
+ * - NEWLINE tracking (a run of blank lines is one token; `\r\n` accepted)
+ * - Brace-balanced content (inline raw `!{:lang: ...}` and `;{...}` comments)
+ * - Bare strings for every value context (block, sameline, embedded,
+ *   bracket, array), with terminators picked from a table
  *
  * This is a simplified scanner for syntax highlighting purposes.
  * It doesn't track precise column positions for inline element nesting.
@@ -24,11 +27,39 @@ enum TokenType {
   RAW_BLOCK_CONTENT,
   FREEFORM_CONTENT,
   END_OF_FILE,
+  BALANCED_CONTENT,
+  BLOCK_BARE_STRING,
+  SAMELINE_BARE_STRING,
+  EMBEDDED_BARE_STRING,
+  BRACKET_BARE_STRING,
+  ARRAY_BARE_STRING,
 };
 
 // Maximum indent stack depth
 #define MAX_INDENT_DEPTH 256
 
+// Bare string terminators per value context (FULL-SPEC "Bare String
+// Terminators"). The grammar makes exactly one of these tokens valid in any
+// value position, so valid_symbols selects the row. `after_blank` ends the
+// value only when preceded by a space or tab - the block value's ` ;`. A '\r'
+// ends a value only as part of "\r\n", which scan_bare_string checks itself.
+typedef struct {
+  enum TokenType symbol;
+  const char *terminators;
+  const char *after_blank;
+} BareStringContext;
+
+static const BareStringContext BARE_STRING_CONTEXTS[] = {
+  {BLOCK_BARE_STRING,    "\n",            ";"},
+  {SAMELINE_BARE_STRING, " \t\n:[];|",   ""},
+  {EMBEDDED_BARE_STRING, " \t\n:[];|}",  ""},
+  {BRACKET_BARE_STRING,  " \t\n]",       ""},
+  {ARRAY_BARE_STRING,    " \t\n[]",      ""},
+};
+
+#define BARE_STRING_CONTEXT_COUNT \
+  (sizeof(BARE_STRING_CONTEXTS) / sizeof(BARE_STRING_CONTEXTS[0]))
+
 // Scanner state
 typedef struct {
   // Indent tracking
@@ -92,6 +123,33 @@ static void skip_to_eol(TSLexer *lexer) {
   }
 }
 
+// True at the start of a line ending ("\n" or "\r\n")
+static inline bool at_newline(TSLexer *lexer) {
+  return lexer->lookahead == '\n' || lexer->lookahead == '\r';
+}
+
+// Consume "\n" or "\r\n". A lone '\r' is content, not a line ending, but has
+// been consumed by the time we know - callers mark_end before calling, or
+// fail the token.
+static bool consume_newline(TSLexer *lexer) {
+  if (lexer->lookahead == '\r') advance(lexer);
+  if (lexer->lookahead != '\n') return false;
+  advance(lexer);
+  return true;
+}
+
+// Extend the current token over any following blank lines. Stops before
+// the first non-blank line, leaving its indentation for the next scan.
+static void absorb_blank_lines(TSLexer *lexer) {
+  for (;;) {
+    while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+      advance(lexer);
+    }
+    if (!consume_newline(lexer)) return;
+    lexer->mark_end(lexer);
+  }
+}
+
 // Check if we're looking at ```
 static bool looking_at_backticks(TSLexer *lexer) {
   if (lexer->lookahead != '`') return false;
@@ -103,6 +161,231 @@ static bool looking_at_backticks(TSLexer *lexer) {
   return true;
 }
 
+// Consume content up to (not including) the `}` that closes the enclosing
+// brace, counting nested `{}` pairs. One linear pass, no nested tokens.
+// Fails on EOF before the closing brace so unbalanced input stays an error.
+static bool scan_balanced_content(TSLexer *lexer) {
+  while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+    skip(lexer);
+  }
+
+  uint32_t depth = 0;
+  bool has_content = false;
+
+  while (!is_eof(lexer)) {
+    if (lexer->lookahead == '{') {
+      depth++;
+    } else if (lexer->lookahead == '}') {
+      if (depth == 0) {
+        lexer->mark_end(lexer);
+        return has_content;
+      }
+      depth--;
+    }
+    advance(lexer);
+    has_content = true;
+  }
+
+  return false;
+}
+
+// During error recovery tree-sitter marks every external token valid; no
+// parse state otherwise allows brace content and a block value together.
+static bool in_error_recovery(const bool *valid_symbols) {
+  return valid_symbols[BALANCED_CONTENT] && valid_symbols[BLOCK_BARE_STRING];
+}
+
+static bool is_terminator(const char *terminators, int32_t c) {
+  return c > 0 && c < 128 && strchr(terminators, (char)c) != NULL;
+}
+
+// States of an incremental match against the grammar's `number` token. The
+// bare-string scanner feeds it one character at a time, so values of any
+// length are classified without buffering them.
+typedef enum {
+  NUM_START,
+  NUM_SIGN,        // -
+  NUM_ZERO,        // 0 (may start 0x / 0o / 0b)
+  NUM_INT,         // 12_3
+  NUM_FRAC_START,  // 1.
+  NUM_FRAC,        // 1.5
+  NUM_EXP_START,   // 1e
+  NUM_EXP_SIGN,    // 1e-
+  NUM_EXP,         // 1e5
+  NUM_HEX_START,   // 0x
+  NUM_HEX,
+  NUM_OCT_START,   // 0o
+  NUM_OCT,
+  NUM_BIN_START,   // 0b
+  NUM_BIN,
+  NUM_RAT_START,   // 1/
+  NUM_RAT,         // 1/2 (needs the trailing r)
+  NUM_IMAG_START,  // 3+
+  NUM_IMAG,        // 3+4
+  NUM_IMAG_FRAC_START,
+  NUM_IMAG_FRAC,   // 3+4.5
+  NUM_DONE,        // after the closing r or i
+  NUM_DEAD,
+} NumberState;
+
+static bool is_digit(int32_t c) { return c >= '0' && c <= '9'; }
+
+static bool is_hex_digit(int32_t c) {
+  return is_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// `negative` is whether the value started with '-'; only the complex form
+// with both parts allows a sign before a bare imaginary number.
+static NumberState number_step(NumberState state, int32_t c, bool negative) {
+  switch (state) {
+    case NUM_START:
+      if (c == '-') return NUM_SIGN;
+      // fallthrough
+    case NUM_SIGN:
+      if (c == '0') return NUM_ZERO;
+      return is_digit(c) ? NUM_INT : NUM_DEAD;
+    case NUM_ZERO:
+      if (c == 'x') return NUM_HEX_START;
+      if (c == 'o') return NUM_OCT_START;
+      if (c == 'b') return NUM_BIN_START;
+      // fallthrough
+    case NUM_INT:
+      if (is_digit(c) || c == '_') return NUM_INT;
+      if (c == '.') return NUM_FRAC_START;
+      if (c == 'e' || c == 'E') return NUM_EXP_START;
+      if (c == '/') return NUM_RAT_START;
+      if (c == '+' || c == '-') return NUM_IMAG_START;
+      if (c == 'i') return negative ? NUM_DEAD : NUM_DONE;
+      return NUM_DEAD;
+    case NUM_FRAC_START:
+      return is_digit(c) ? NUM_FRAC : NUM_DEAD;
+    case NUM_FRAC:
+      if (is_digit(c) || c == '_') return NUM_FRAC;
+      if (c == 'e' || c == 'E') return NUM_EXP_START;
+      if (c == '+' || c == '-') return NUM_IMAG_START;
+      if (c == 'i') return negative ? NUM_DEAD : NUM_DONE;
+      return NUM_DEAD;
+    case NUM_EXP_START:
+      if (c == '+' || c == '-') return NUM_EXP_SIGN;
+      // fallthrough
+    case NUM_EXP_SIGN:
+    case NUM_EXP:
+      return is_digit(c) ? NUM_EXP : NUM_DEAD;
+    case NUM_HEX_START:
+      return is_hex_digit(c) ? NUM_HEX : NUM_DEAD;
+    case NUM_HEX:
+      return is_hex_digit(c) || c == '_' ? NUM_HEX : NUM_DEAD;
+    case NUM_OCT_START:
+      return c >= '0' && c <= '7' ? NUM_OCT : NUM_DEAD;
+    case NUM_OCT:
+      return (c >= '0' && c <= '7') || c == '_' ? NUM_OCT : NUM_DEAD;
+    case NUM_BIN_START:
+      return c == '0' || c == '1' ? NUM_BIN : NUM_DEAD;
+    case NUM_BIN:
+      return c == '0' || c == '1' || c == '_' ? NUM_BIN : NUM_DEAD;
+    case NUM_RAT_START:
+      return is_digit(c) ? NUM_RAT : NUM_DEAD;
+    case NUM_RAT:
+      if (is_digit(c) || c == '_') return NUM_RAT;
+      return c == 'r' ? NUM_DONE : NUM_DEAD;
+    case NUM_IMAG_START:
+      return is_digit(c) ? NUM_IMAG : NUM_DEAD;
+    case NUM_IMAG:
+      if (is_digit(c) || c == '_') return NUM_IMAG;
+      if (c == '.') return NUM_IMAG_FRAC_START;
+      return c == 'i' ? NUM_DONE : NUM_DEAD;
+    case NUM_IMAG_FRAC_START:
+      return is_digit(c) ? NUM_IMAG_FRAC : NUM_DEAD;
+    case NUM_IMAG_FRAC:
+      if (is_digit(c) || c == '_') return NUM_IMAG_FRAC;
+      return c == 'i' ? NUM_DONE : NUM_DEAD;
+    default:
+      return NUM_DEAD;
+  }
+}
+
+static bool number_accepts(NumberState state) {
+  switch (state) {
+    case NUM_ZERO:
+    case NUM_INT:
+    case NUM_FRAC:
+    case NUM_EXP:
+    case NUM_HEX:
+    case NUM_OCT:
+    case NUM_BIN:
+    case NUM_DONE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Keywords and lone opening delimiters the grammar lexes as something other
+// than a bare string when they make up the whole value
+#define KEYWORD_MAX 5
+
+static bool is_keyword(const char *s, size_t n) {
+  static const char *const keywords[] = {
+    "true", "false", "null", "nil", "\"", "'", "[", "!{{",
+  };
+  for (size_t i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++) {
+    if (strlen(keywords[i]) == n && memcmp(keywords[i], s, n) == 0) return true;
+  }
+  return false;
+}
+
+// Consume a bare string up to the context's terminator. Fails (deferring to
+// the internal lexer) when the whole value is a number or keyword, matching
+// the old regex tokens, which lost same-length ties to those. Blanks before
+// a terminator are left out of the token. `after_cr` is set when the caller
+// has already consumed a lone '\r' as the value's first character.
+static bool scan_bare_string(TSLexer *lexer, const BareStringContext *context, bool after_cr) {
+  char prefix[KEYWORD_MAX] = {0};
+  size_t length = after_cr ? 1 : 0, marked_length = 0;
+  bool negative = lexer->lookahead == '-';
+  bool after_blank = false, line_end = false;
+  NumberState number = after_cr ? NUM_DEAD : NUM_START, marked_number = NUM_START;
+
+  while (!is_eof(lexer) && !is_terminator(context->terminators, lexer->lookahead)) {
+    bool blank = lexer->lookahead == ' ' || lexer->lookahead == '\t';
+    if ((blank || lexer->lookahead == '\r') && !after_blank) {
+      lexer->mark_end(lexer);
+      marked_length = length;
+      marked_number = number;
+    } else if (after_blank && is_terminator(context->after_blank, lexer->lookahead)) {
+      break;
+    }
+    if (lexer->lookahead == '\r') {
+      advance(lexer);
+      if (lexer->lookahead == '\n') {
+        line_end = true;
+        break;
+      }
+      length++;  // A lone '\r' is content, and never part of a number
+      number = NUM_DEAD;
+      after_blank = false;
+      continue;
+    }
+    if (length < KEYWORD_MAX) {
+      prefix[length] = lexer->lookahead < 128 ? (char)lexer->lookahead : 0;
+    }
+    number = number_step(number, lexer->lookahead, negative);
+    length++;
+    advance(lexer);
+    after_blank = blank;
+  }
+  if (!after_blank && !line_end) {
+    lexer->mark_end(lexer);
+    marked_length = length;
+    marked_number = number;
+  }
+
+  if (marked_length == 0) return false;
+  if (number_accepts(marked_number)) return false;
+  if (marked_length <= KEYWORD_MAX && is_keyword(prefix, marked_length)) return false;
+  return true;
+}
+
 // ============================================================================
 // Scanner Functions
 // ============================================================================
@@ -244,8 +527,8 @@ bool tree_sitter_udon_external_scanner_scan(
     lexer->mark_end(lexer);
 
     // Skip initial newline if present
-    if (lexer->lookahead == '\n') {
-      advance(lexer);
+    if (at_newline(lexer)) {
+      consume_newline(lexer);
     }
 
     bool found_content = false;
@@ -255,12 +538,12 @@ bool tree_sitter_udon_external_scanner_scan(
       uint16_t line_indent = count_indent(lexer);
 
       // If we've dedented to or past the base, we're done
-      if (lexer->lookahead != '\n' && line_indent <= scanner->raw_block_base_column) {
+      if (!at_newline(lexer) && line_indent <= scanner->raw_block_base_column) {
         scanner->in_raw_block = false;
         return found_content;
       }
 
-      // Consume the rest of the line
+      // Consume the rest of the line (a trailing '\r' stays in the content)
       while (!is_eof(lexer) && lexer->lookahead != '\n') {
         advance(lexer);
         found_content = true;
@@ -278,20 +561,34 @@ bool tree_sitter_udon_external_scanner_scan(
     return found_content;
   }
 
+  // -------------------------------------------------------------------------
+  // Brace-balanced content (not during error recovery, where scanning to a
+  // distant `}` would only add churn)
+  // -------------------------------------------------------------------------
+  if (valid_symbols[BALANCED_CONTENT] && !in_error_recovery(valid_symbols)) {
+    lexer->result_symbol = BALANCED_CONTENT;
+    return scan_balanced_content(lexer);
+  }
+
   // -------------------------------------------------------------------------
   // At start of line - handle indentation
   // -------------------------------------------------------------------------
   if (get_column(lexer) == 0) {
     uint16_t indent = count_indent(lexer);
 
-    // Skip blank lines
-    if (lexer->lookahead == '\n') {
-      if (valid_symbols[NEWLINE]) {
-        advance(lexer);
+    // A run of blank lines is a single NEWLINE. A lone '\r' is content:
+    // indentation still applies, with any token ending before it.
+    bool lone_cr = false;
+    if (at_newline(lexer)) {
+      lexer->mark_end(lexer);
+      if (consume_newline(lexer)) {
+        if (!valid_symbols[NEWLINE]) return false;
+        lexer->mark_end(lexer);
+        absorb_blank_lines(lexer);
         lexer->result_symbol = NEWLINE;
         return true;
       }
-      return false;
+      lone_cr = true;
     }
 
     // Skip comment-only lines for indent purposes?
@@ -300,7 +597,7 @@ bool tree_sitter_udon_external_scanner_scan(
     uint16_t current_indent = scanner->indent_stack[scanner->indent_depth - 1];
 
     // Check for freeform opening
-    if (lexer->lookahead == '`' && looking_at_backticks(lexer)) {
+    if (!lone_cr && lexer->lookahead == '`' && looking_at_backticks(lexer)) {
       scanner->in_freeform = true;
       scanner->freeform_open_column = indent;
       // Let the grammar handle the ``` token
@@ -348,11 +645,49 @@ bool tree_sitter_udon_external_scanner_scan(
     return false;
   }
 
+  // -------------------------------------------------------------------------
+  // Bare strings - one scanner for all value contexts
+  // -------------------------------------------------------------------------
+  if (!in_error_recovery(valid_symbols)) {
+    for (size_t i = 0; i < BARE_STRING_CONTEXT_COUNT; i++) {
+      const BareStringContext *context = &BARE_STRING_CONTEXTS[i];
+      if (!valid_symbols[context->symbol]) continue;
+
+      while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+        skip(lexer);
+      }
+      // Blanks were just skipped, so an `after_blank` terminator counts too
+      if (is_eof(lexer) ||
+          is_terminator(context->terminators, lexer->lookahead) ||
+          is_terminator(context->after_blank, lexer->lookahead)) {
+        break;  // No value here; a NEWLINE may still be
+      }
+      bool after_cr = false;
+      if (lexer->lookahead == '\r') {
+        lexer->mark_end(lexer);
+        advance(lexer);
+        if (lexer->lookahead == '\n') {
+          if (!valid_symbols[NEWLINE]) return false;
+          advance(lexer);
+          lexer->mark_end(lexer);
+          absorb_blank_lines(lexer);
+          lexer->result_symbol = NEWLINE;
+          return true;
+        }
+        after_cr = true;
+      }
+      lexer->result_symbol = context->symbol;
+      return scan_bare_string(lexer, context, after_cr);
+    }
+  }
+
   // -------------------------------------------------------------------------
   // NEWLINE handling (not at column 0)
   // -------------------------------------------------------------------------
-  if (lexer->lookahead == '\n' && valid_symbols[NEWLINE]) {
-    advance(lexer);
+  if (at_newline(lexer) && valid_symbols[NEWLINE]) {
+    if (!consume_newline(lexer)) return false;
+    lexer->mark_end(lexer);
+    absorb_blank_lines(lexer);
     lexer->result_symbol = NEWLINE;
     return true;
   }